@@ -18,6 +18,7 @@
 #include "Circle.h"
 #include "Ellipse.h"
 #include "Helix.h"
+#include "CurveView.h"
 
 /**
  * @brief Generate a random double value within the specified range.
@@ -34,10 +35,10 @@ double generateRandValue(double minValue, double maxValue);
  *
  * This function prints the coordinates of points and derivatives of all curves in the container at the specified value of 't'.
  *
- * @param curves A vector of shared pointers to Curve objects.
+ * @param curves A non-owning span over the container of shared pointers to Curve objects.
  * @param t The value of 't' at which to calculate the coordinates.
  */
-void printCoordinatesOfPointsAndDerivativesOfAllCurves(std::vector<std::shared_ptr<Curve>> curves, double t);
+void printCoordinatesOfPointsAndDerivativesOfAllCurves(CurveSpan<Curve> curves, double t);
 
 int main()
 {
@@ -84,23 +85,14 @@ int main()
 
     //4. Populate a second container that would contain only circles from the first container. Make sure the
     //second container shares(i.e. not clones) circles of the first one, e.g.via pointers.
-    std::vector<std::shared_ptr<Circle>> circles;
-
-    for (const auto& curve : curves)
-    {
-        std::shared_ptr<Circle> circlePtr = std::dynamic_pointer_cast<Circle>(curve);
-
-        if (circlePtr)
-        {
-            circles.push_back(circlePtr);
-        }
-    }
+    //The view stores only indices into the first container, so no shared_ptr is copied.
+    CurveIndexView<Circle> circles = filterByType<Circle>(curves);
 
     //5. Sort the second container in the ascending order of circles’ radii. That is, the first element has the
     //smallest radius, the last - the greatest.
-    std::sort(circles.begin(), circles.end(), [](std::shared_ptr<Circle> const& circle1, std::shared_ptr<Circle> const& circle2)
+    circles.sort([](Circle& circle1, Circle& circle2)
         {
-            return circle1->getRadius() < circle2->getRadius();
+            return circle1.getRadius() < circle2.getRadius();
         });
 
     //6. Compute the total sum of radii of all curves in the second container.
@@ -108,9 +100,9 @@ int main()
     double sumRadii = 0.0;
 
     #pragma omp parallel for num_threads(8) reduction(+:sumRadii)
-    for (int i = 0; i < circles.size(); i++)
+    for (int i = 0; i < static_cast<int>(circles.size()); i++)
     {
-        sumRadii += circles[i]->getRadius();
+        sumRadii += circles[i].getRadius();
     }
 
     std::cout << "Sum of radii of all circles: " << sumRadii << '\n';
@@ -136,7 +128,7 @@ double generateRandValue(double minValue, double maxValue)
     }
 }
 
-void printCoordinatesOfPointsAndDerivativesOfAllCurves(std::vector<std::shared_ptr<Curve>> curves, double t)
+void printCoordinatesOfPointsAndDerivativesOfAllCurves(CurveSpan<Curve> curves, double t)
 {
     std::cout << "Coordinates of points and derivatives of all curves in the container at t = " << t << '\n';
     std::cout << "--------------------------------\n";
@@ -146,7 +138,7 @@ void printCoordinatesOfPointsAndDerivativesOfAllCurves(std::vector<std::shared_p
 
         try
         {
-            Point point = curves[i]->getPointByParametricExpression(t);
+            Point point = curves[i].getPointByParametricExpression(t);
             std::cout << "Point:\n" << point << '\n';
         }
         catch (const std::invalid_argument& ex)
@@ -156,7 +148,7 @@ void printCoordinatesOfPointsAndDerivativesOfAllCurves(std::vector<std::shared_p
 
         try
         {
-            Point derivative = curves[i]->firstDerivativeByParametricExpression(t);
+            Point derivative = curves[i].firstDerivativeByParametricExpression(t);
             std::cout << "Derivative:\n" << derivative << '\n';
         }
         catch (const std::invalid_argument& ex)
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Curve.h"
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+
+/**
+ * @class CurveHandle
+ * @brief The CurveHandle class represents a non-owning reference to a curve of type T.
+ *
+ * A handle only borrows the curve: it stores a raw pointer and never touches the reference count of the
+ * std::shared_ptr that owns the object. The owning container must outlive every handle made from it.
+ */
+template <typename T>
+class CurveHandle
+{
+private:
+	T* curve;
+public:
+	CurveHandle():curve(nullptr){}
+	explicit CurveHandle(T* curvePtr):curve(curvePtr){}
+	explicit CurveHandle(const std::shared_ptr<T>& curvePtr):curve(curvePtr.get()){}
+
+	T* get() const { return curve; }
+	T& operator*() const { return *curve; }
+	T* operator->() const { return curve; }
+	explicit operator bool() const { return curve != nullptr; }
+};
+
+/**
+ * @class CurveSpan
+ * @brief The CurveSpan class represents a non-owning view over a contiguous sequence of shared pointers to curves.
+ *
+ * The span is passed by value instead of the owning vector, so reading curves through it copies neither the
+ * vector nor any std::shared_ptr. Elements are returned as references to the curves themselves.
+ * The owning container must outlive the span and must not be resized while the span is in use.
+ */
+template <typename T>
+class CurveSpan
+{
+private:
+	const std::shared_ptr<T>* first;
+	size_t count;
+public:
+	CurveSpan():first(nullptr), count(0){}
+	CurveSpan(const std::shared_ptr<T>* firstPtr, size_t countValue):first(firstPtr), count(countValue){}
+	CurveSpan(const std::vector<std::shared_ptr<T>>& curves):first(curves.data()), count(curves.size()){}
+
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	T& operator[](size_t index) const { return *first[index]; }
+	CurveHandle<T> handle(size_t index) const { return CurveHandle<T>(first[index].get()); }
+};
+
+/**
+ * @class CurveIndexView
+ * @brief The CurveIndexView class represents a filtered and/or reordered view over a span of curves.
+ *
+ * The view stores only the indices of the selected curves in the underlying span, so filtering and sorting
+ * never copy a std::shared_ptr. Elements are returned as references to T, where T is the concrete curve type
+ * that was used for filtering (see filterByType).
+ * The owning container must outlive the view and must not be modified while the view is in use.
+ */
+template <typename T>
+class CurveIndexView
+{
+private:
+	CurveSpan<Curve> curves;
+	std::vector<size_t> indices;
+public:
+	CurveIndexView(){}
+	CurveIndexView(CurveSpan<Curve> curvesSpan, std::vector<size_t> indicesValue)
+		:curves(curvesSpan), indices(std::move(indicesValue)){}
+
+	size_t size() const { return indices.size(); }
+	bool empty() const { return indices.empty(); }
+
+	T& operator[](size_t index) const { return static_cast<T&>(curves[indices[index]]); }
+	CurveHandle<T> handle(size_t index) const { return CurveHandle<T>(&(*this)[index]); }
+	size_t sourceIndex(size_t index) const { return indices[index]; }
+
+	/**
+	 * @brief Sort the view with the given comparator.
+	 *
+	 * Only the stored indices are reordered; the underlying container is left untouched.
+	 *
+	 * @param compare A strict weak ordering taking two references to T.
+	 */
+	template <typename Compare>
+	void sort(Compare compare)
+	{
+		std::sort(indices.begin(), indices.end(), [this, &compare](size_t index1, size_t index2)
+			{
+				return compare(static_cast<T&>(curves[index1]), static_cast<T&>(curves[index2]));
+			});
+	}
+};
+
+/**
+ * @brief Create a view over the curves of the span that are of type T.
+ *
+ * The type of every curve is checked once here with dynamic_cast, so subsequent access through the view
+ * needs no further casts or reference count updates.
+ *
+ * @param curves A span over the owning container of curves.
+ * @return A view containing the indices of all curves of type T, in the order of the container.
+ */
+template <typename T>
+CurveIndexView<T> filterByType(CurveSpan<Curve> curves)
+{
+	std::vector<size_t> indices;
+
+	for (size_t i = 0; i < curves.size(); i++)
+	{
+		if (dynamic_cast<T*>(curves.handle(i).get()))
+		{
+			indices.push_back(i);
+		}
+	}
+
+	return CurveIndexView<T>(curves, std::move(indices));
+}